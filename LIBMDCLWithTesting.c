@@ -40,6 +40,79 @@ Examples: (Note that CreateList must always be used first and DeleteList must AL
 	Function:	DeleteList(struct NodeManager*);
 	Example:	bool SuccessOnTrueFailiureOnFalse = DeleteList(MyListManager);
 
+	Function:	CreateLRUCache(int Capacity, const char* CacheID, LRUEvictionCallback EvictionCallback, void* CallbackContext);
+	Example:	struct LRUCache* MyCache = CreateLRUCache(1024, "MyCacheName", MyEvictionFunction, NULL);	(EvictionCallback may be NULL)
+
+	Function:	LRUPut(struct LRUCache*, unsigned long long Key, void* data);
+	Example:	struct Node* MyCachedNode = LRUPut(MyCache, 42, &MyDataIWantToStoreInANode);
+
+	Function:	LRUGet(struct LRUCache*, unsigned long long Key);
+	Example:	struct Node* MyCachedNode = LRUGet(MyCache, 42);		(returns NULL on a cache miss)
+
+	Function:	LRUEvict(struct LRUCache*);
+	Example:	bool SuccessOnTrueFailiureOnFalse = LRUEvict(MyCache);
+
+	Function:	DeleteLRUCache(struct LRUCache*);
+	Example:	bool SuccessOnTrueFailiureOnFalse = DeleteLRUCache(MyCache);
+
+	Function:	BeginListBatch(struct NodeManager*);
+	Example:	struct ListBatch* MyBatch = BeginListBatch(MyListManager);
+
+	Function:	BatchInsertNode(struct ListBatch*, int position, void* data);	(position is the position before the batch, the new node goes in front of that node)
+	Example:	bool SuccessOnTrueFailiureOnFalse = BatchInsertNode(MyBatch, 3, &MyDataIWantToStoreInANode);
+
+	Function:	BatchDeleteNode(struct ListBatch*, int position);		(position is the position before the batch)
+	Example:	bool SuccessOnTrueFailiureOnFalse = BatchDeleteNode(MyBatch, 5);
+
+	Function:	CommitListBatch(struct ListBatch*);				(applies every queued operation at once and frees the batch, on failure the list is left untouched)
+	Example:	bool SuccessOnTrueFailiureOnFalse = CommitListBatch(MyBatch);
+
+	Function:	CancelListBatch(struct ListBatch*);				(frees the batch without applying it)
+	Example:	bool SuccessOnTrueFailiureOnFalse = CancelListBatch(MyBatch);
+
+	While lazy deletes are on, every position (inserts, deletes, SetNodeData, EmptyNodeData, handles and batches) is the node's index in NodeArray,
+	tombstones included. Inserts shift later nodes and tombstones up by one, only a compaction removes tombstones and renumbers positions.
+
+	Function:	EnableLazyDelete(struct NodeManager*, double CompactRatio);	(deletes now only unlink and mark the node, the list compacts once tombstones exceed CompactRatio of NodeCount)
+	Example:	bool SuccessOnTrueFailiureOnFalse = EnableLazyDelete(MyListManager, 0.25);
+
+	Function:	CompactList(struct NodeManager*);				(removes every tombstone now, positions are renumbered)
+	Example:	bool SuccessOnTrueFailiureOnFalse = CompactList(MyListManager);
+
+	Function:	DisableLazyDelete(struct NodeManager*);
+	Example:	bool SuccessOnTrueFailiureOnFalse = DisableLazyDelete(MyListManager);
+
+	Function:	GetNodeHandle(struct NodeManager*, int position);		(needs lazy deletes enabled)
+	Example:	struct NodeHandle MyHandle = GetNodeHandle(MyListManager, 3);
+
+	Function:	ResolveNodeHandle(struct NodeManager*, struct NodeHandle);	(returns NULL once the node was deleted or moved to another position)
+	Example:	struct Node* MyNode = ResolveNodeHandle(MyListManager, MyHandle);
+
+	A split list keeps only an 8 byte payload per node. Its nodes are always in array order, so next, prev and position follow from the index and are not stored.
+	Its NodeArray, head and tail are NULL unless GetNodeView built the read only view, use the split functions and the accessors below instead.
+	The InsertNodeAt functions fail on split lists (the node they return could only be a copy), the delete functions, SetNodeData and EmptyNodeData work as usual.
+
+	Function:	CreateSplitList(int NodeCount, const char* ListID);		(lazy deletes are not supported)
+	Example:	struct NodeManager* MySplitListManager = CreateSplitList(10, "MySplitListName");
+
+	Function:	InsertSplitNode(struct NodeManager*, int position, void* data);	(returns the new node's position, -1 on failure)
+	Example:	int MyNewPosition = InsertSplitNode(MySplitListManager, 3, &MyDataIWantToStoreInANode);
+
+	Function:	DeleteSplitNode(struct NodeManager*, int position);
+	Example:	bool SuccessOnTrueFailiureOnFalse = DeleteSplitNode(MySplitListManager, 3);
+
+	Function:	GetNodeData(struct NodeManager*, int position);			(works for both layouts)
+	Example:	void* MyData = GetNodeData(MySplitListManager, 3);
+
+	Function:	GetNextPosition(struct NodeManager*, int position);		(works for both layouts, GetPrevPosition is the same the other way)
+	Example:	int MyNextPosition = GetNextPosition(MySplitListManager, 3);
+
+	Function:	GetNodeView(struct NodeManager*, int position);			(for split lists this builds a read only copy in NodeArray, head and tail that the next insert, delete or batch commit frees)
+	Example:	const struct Node* MyNode = GetNodeView(MySplitListManager, 3);
+
+	Function:	ReleaseNodeView(struct NodeManager*);				(frees the view of a split list early, does nothing for other lists)
+	Example:	bool SuccessOnTrueFailiureOnFalse = ReleaseNodeView(MySplitListManager);
+
 */
 
 
@@ -57,9 +130,56 @@ struct NodeManager  			// this is the wrapper for all nodes in an instance of No
 {
 	char ListID[30];		// used to Identify the specific list
 	int NodeCount;			// the amount of nodes to be created by the create list function
-	struct Node* head;		// should always point to the 0 index of the node array
-	struct Node* tail;		// should always point to the last index of the node array
+	struct Node* head;		// should always point to the 0 index of the node array (with LazyDelete on, the first node that is not a tombstone)
+	struct Node* tail;		// should always point to the last index of the node array (with LazyDelete on, the last node that is not a tombstone)
 	struct Node* NodeArray;		// this is a pointer to the node array for this instance of NodeManager
+	unsigned int Modifications;	// bumped by every insert, delete, compaction and batch commit so a batch can tell the list changed since it began
+	bool LazyDelete;		// when true deletes leave a tombstone in NodeArray instead of shifting every later node
+	double CompactRatio;		// with LazyDelete on, the list compacts once TombstoneCount exceeds this fraction of NodeCount
+	int TombstoneCount;		// the amount of deleted nodes still taking up space in NodeArray
+	unsigned int* Generations;	// the generation of each node in NodeArray, 0 marks a tombstone. Only allocated while LazyDelete is on
+	unsigned int NextGeneration;	// the last generation handed out, every new node gets a new one and nodes moved by a compaction do too
+	bool SplitLayout;		// when true nodes live in Payloads, and NodeArray, head and tail are NULL unless GetNodeView built a read only view
+	void** Payloads;		// the data of each node of a split list, 8 bytes per node so payload only scans stay dense
+};
+
+struct NodeHandle			// a reference to a node that can tell when the node it pointed to was deleted or moved
+{
+	int position;			// the position of the node when the handle was made
+	unsigned int generation;	// the generation of the node when the handle was made
+};
+
+typedef void (*LRUEvictionCallback)(unsigned long long Key, void* data, void* context);	// called with the key and data of every entry pushed out of an LRUCache
+
+struct LRUCache				// a fixed capacity least recently used cache. Its NodeArray is allocated once and never reallocated, so node addresses stay stable
+{
+	char CacheID[30];		// used to Identify the specific cache
+	int Capacity;			// the maximum amount of entries the cache holds before evicting
+	int Count;			// the amount of entries currently in the cache
+	struct NodeManager* Manager;	// head is the most recently used entry and tail the least recently used. Unused nodes sit between tail and head in the ring
+	unsigned long long* Keys;	// the key stored in each node, indexed by node position
+	int* HashIndex;			// open addressing (linear probing) table of node positions, -1 marks an empty slot
+	int HashMask;			// the size of HashIndex minus one, the size is always a power of two
+	LRUEvictionCallback EvictionCallback;	// optional, called whenever an entry is evicted
+	void* CallbackContext;		// passed through untouched to EvictionCallback
+};
+
+struct ListBatchOperation		// a single queued insert or delete, positions are the positions from before the batch
+{
+	int position;			// the pre-batch position the operation applies to
+	int sequence;			// the order the operation was queued in, keeps inserts at the same position in order
+	bool insert;			// true for an insert, false for a delete
+	void* data;			// the data for an inserted node
+};
+
+struct ListBatch			// queues inserts and deletes so they can be applied to a list with one allocation and one relink
+{
+	struct NodeManager* Manager;	// the list the batch will be committed to
+	int NodeCount;			// the NodeCount of the list when the batch began
+	unsigned int Modifications;	// the Modifications of the list when the batch began
+	int OperationCount;		// the amount of operations queued
+	int OperationCapacity;		// the amount of operations the queue can hold before growing
+	struct ListBatchOperation* Operations;	// the queued operations
 };
 
 
@@ -75,6 +195,37 @@ bool DeleteNodeAtBeginning		(struct NodeManager*);					// deletes the head and r
 bool DeleteNodeAtPosition		(struct NodeManager*, int position);			// deletes a node at a specific node and returns the success of the operation
 bool SetNodeData			(struct NodeManager*, int position, void* data);	// sets the char data of a node at the specified position for the given list
 bool EmptyNodeData			(struct NodeManager*, int position);			// sets the char data of a given node to 0s for the given list
+struct LRUCache* CreateLRUCache		(int Capacity, const char* CacheID, LRUEvictionCallback EvictionCallback, void* CallbackContext);	// creates an LRU cache holding at most Capacity entries
+struct Node* LRUGet			(struct LRUCache*, unsigned long long Key);		// looks up a key and marks it most recently used, returns NULL on a miss
+struct Node* LRUPut			(struct LRUCache*, unsigned long long Key, void* data);	// inserts or updates a key, evicting the least recently used entry when full
+bool LRUEvict				(struct LRUCache*);					// evicts the least recently used entry and returns whether there was one to evict
+bool DeleteLRUCache			(struct LRUCache*);					// frees the cache and its list, remaining entries are not passed to the eviction callback
+struct ListBatch* BeginListBatch	(struct NodeManager*);					// starts queuing inserts and deletes for a list
+bool BatchInsertNode			(struct ListBatch*, int position, void* data);		// queues a new node in front of the node at the given pre-batch position
+bool BatchDeleteNode			(struct ListBatch*, int position);			// queues the deletion of the node at the given pre-batch position
+bool CommitListBatch			(struct ListBatch*);					// applies every queued operation in one pass and frees the batch
+bool CancelListBatch			(struct ListBatch*);					// frees the batch without applying it
+bool EnableLazyDelete			(struct NodeManager*, double CompactRatio);		// makes deletes leave tombstones that are compacted away later
+bool DisableLazyDelete			(struct NodeManager*);					// compacts the list and goes back to compacting on every delete
+bool CompactList			(struct NodeManager*);					// removes every tombstone from the list and renumbers positions
+struct NodeHandle GetNodeHandle		(struct NodeManager*, int position);			// makes a generation checked handle to the node at a position
+struct Node* ResolveNodeHandle		(struct NodeManager*, struct NodeHandle);		// returns the node a handle refers to, or NULL if the handle is stale
+struct NodeManager* CreateSplitList	(int NodeCount, const char* ListID);			// creates a list that keeps only a payload array, links and positions follow from the index
+int InsertSplitNode			(struct NodeManager*, int position, void* data);	// inserts a node holding data into a split list and returns its position, -1 on failure
+bool DeleteSplitNode			(struct NodeManager*, int position);			// deletes a node from a split list
+const struct Node* GetNodeView		(struct NodeManager*, int position);			// returns the struct Node for a position, building the read only view first for split lists
+bool ReleaseNodeView			(struct NodeManager*);					// frees the view of a split list
+void* GetNodeData			(struct NodeManager*, int position);			// returns the data of the node at a position
+int GetNextPosition			(struct NodeManager*, int position);			// returns the position of the next node, -1 on error
+int GetPrevPosition			(struct NodeManager*, int position);			// returns the position of the previous node, -1 on error
+
+/* Internal Function Prototypes */
+
+static unsigned int NewGeneration	(struct NodeManager*);					// hands out the next generation for a lazy delete list
+static bool TombstoneNode		(struct NodeManager*, int position);			// the lazy delete version of the delete functions
+static struct Node* InsertLazyNode	(struct NodeManager*, int position);			// the lazy delete version of the insert functions
+static void RelinkLazyList		(struct NodeManager*);					// links the live nodes of a lazy delete list in array order
+static bool CommitSplitListBatch	(struct ListBatch*, int NewNodeCount);			// the split layout version of CommitListBatch
 
 /* Functions */
 
@@ -152,6 +303,22 @@ struct Node* InsertNodeAtEnd(struct NodeManager* NodeManager) 		// Realloc for e
 		return NULL;
 	}
 
+	// counted before anything else, even a failed call can leave the list changed
+	NodeManager->Modifications += 1;
+
+	// a split list has no struct Node to hand back, only a copy that would silently drop writes
+	if (NodeManager->SplitLayout)
+	{
+		fprintf(stderr, "\nInsertNodeAtEnd Function cannot insert into a split list, use InsertSplitNode\n");
+		return NULL;
+	}
+
+	// lazy delete lists keep generations in step with the nodes
+	if (NodeManager->LazyDelete)
+	{
+		return InsertLazyNode(NodeManager, NodeManager->NodeCount);
+	}
+
 	// setting local variables to NodeManager's NodeCount and NodeArray for readability
 	int NodeCount = NodeManager->NodeCount;
 	struct Node* NodeArray = NodeManager->NodeArray;
@@ -215,6 +382,22 @@ struct Node* InsertNodeAtBeginning(struct NodeManager* NodeManager)
 		return NULL;
 	}
 
+	// counted before anything else, even a failed call can leave the list changed
+	NodeManager->Modifications += 1;
+
+	// a split list has no struct Node to hand back, only a copy that would silently drop writes
+	if (NodeManager->SplitLayout)
+	{
+		fprintf(stderr, "\nInsertNodeAtBeginning Function cannot insert into a split list, use InsertSplitNode\n");
+		return NULL;
+	}
+
+	// lazy delete lists keep generations in step with the nodes
+	if (NodeManager->LazyDelete)
+	{
+		return InsertLazyNode(NodeManager, 0);
+	}
+
 	// setting local variables to NodeManager's NodeCount and NodeArray for readability
 	int NodeCount = NodeManager->NodeCount;
 	struct Node* NodeArray = NodeManager->NodeArray;
@@ -290,6 +473,22 @@ struct Node* InsertNodeAtPosition(struct NodeManager* NodeManager, int position)
 		return NULL;
 	}
 
+	// counted before anything else, even a failed call can leave the list changed
+	NodeManager->Modifications += 1;
+
+	// a split list has no struct Node to hand back, only a copy that would silently drop writes
+	if (NodeManager->SplitLayout)
+	{
+		fprintf(stderr, "\nInsertNodeAtPosition Function cannot insert into a split list, use InsertSplitNode\n");
+		return NULL;
+	}
+
+	// lazy delete lists keep generations in step with the nodes, position is the NodeArray index tombstones included
+	if (NodeManager->LazyDelete)
+	{
+		return InsertLazyNode(NodeManager, position);
+	}
+
 
 	// setting local variables to NodeManager's NodeCount and NodeArray for readability
 	int NodeCount = NodeManager->NodeCount;
@@ -381,7 +580,10 @@ bool DeleteList(struct NodeManager* NodeManager)
 		return false;
 	}
 	
-	// freeing nodemanager memory	
+	// freeing nodemanager memory, NodeArray is the list itself or the view of a split list
+	free(NodeManager->NodeArray);
+	free(NodeManager->Generations);
+	free(NodeManager->Payloads);
 	free(NodeManager);
 
 	// setting nodemanager to NULL for error checking purposes
@@ -400,6 +602,21 @@ bool DeleteNodeAtEnd(struct NodeManager* NodeManager)
 		return false;
 	}
 
+	// counted before anything else, even a failed call can leave the list changed
+	NodeManager->Modifications += 1;
+
+	// split layout lists shift payloads rather than whole nodes
+	if (NodeManager->SplitLayout)
+	{
+		return DeleteSplitNode(NodeManager, NodeManager->NodeCount - 1);
+	}
+
+	// lazy delete lists only mark the node
+	if (NodeManager->LazyDelete)
+	{
+		return TombstoneNode(NodeManager, NodeManager->tail->position);
+	}
+
 	// setting local variables to NodeManager's NodeCount and NodeArray for readability
 	NodeManager->NodeCount -= 1;
 	int NodeCount = NodeManager->NodeCount;
@@ -425,6 +642,7 @@ bool DeleteNodeAtEnd(struct NodeManager* NodeManager)
 		{
 			NodeArray[i].prev = &NodeArray[NodeCount - 1];
 			NodeArray[i].next = &NodeArray[i + 1];
+			NodeManager->head = &NodeArray[i];
 		}
 		else if (i == NodeCount - 1)				// setting the new tail node
 		{
@@ -455,6 +673,21 @@ bool DeleteNodeAtBeginning(struct NodeManager* NodeManager)
 		return false;
 	}
 
+	// counted before anything else, even a failed call can leave the list changed
+	NodeManager->Modifications += 1;
+
+	// split layout lists shift payloads rather than whole nodes
+	if (NodeManager->SplitLayout)
+	{
+		return DeleteSplitNode(NodeManager, 0);
+	}
+
+	// lazy delete lists only mark the node
+	if (NodeManager->LazyDelete)
+	{
+		return TombstoneNode(NodeManager, NodeManager->head->position);
+	}
+
 	// setting local variables to NodeManager's NodeCount and NodeArray for readability
 	NodeManager->NodeCount -= 1;
 	int NodeCount = NodeManager->NodeCount;
@@ -522,6 +755,21 @@ bool DeleteNodeAtPosition(struct NodeManager* NodeManager, int position)
 		return false;
 	}
 
+	// counted before anything else, even a failed call can leave the list changed
+	NodeManager->Modifications += 1;
+
+	// split layout lists shift payloads rather than whole nodes
+	if (NodeManager->SplitLayout)
+	{
+		return DeleteSplitNode(NodeManager, position);
+	}
+
+	// lazy delete lists only mark the node, position is the node's index in NodeArray
+	if (NodeManager->LazyDelete)
+	{
+		return TombstoneNode(NodeManager, position);
+	}
+
 	// setting local variables to NodeManager's NodeCount and NodeArray for readability
 	NodeManager->NodeCount -= 1;
 	int NodeCount = NodeManager->NodeCount;
@@ -621,7 +869,25 @@ bool SetNodeData(struct NodeManager* NodeManager, int position, void* data)
 		return false;
 	}
 
-	NodeArray[position].data = data;
+	// tombstones are no longer part of the list
+	if (NodeManager->LazyDelete && NodeManager->Generations[position] == 0)
+	{
+		fprintf(stderr, "\nNode at position %d is deleted\n", position);
+		return false;
+	}
+
+	if (NodeManager->SplitLayout)
+	{
+		NodeManager->Payloads[position] = data;
+		if (NodeArray != NULL)					// keeping an existing view in step
+		{
+			NodeArray[position].data = data;
+		}
+	}
+	else
+	{
+		NodeArray[position].data = data;
+	}
 
 	// error checking data
 	if (data ==  NULL)
@@ -655,86 +921,1976 @@ bool EmptyNodeData(struct NodeManager* NodeManager, int position)
 		return false;
 	}
 
+	// tombstones are no longer part of the list
+	if (NodeManager->LazyDelete && NodeManager->Generations[position] == 0)
+	{
+		fprintf(stderr, "\nNode at position %d is deleted\n", position);
+		return false;
+	}
+
 	// emptying the data
-	NodeArray[position].data = NULL;
+	if (NodeManager->SplitLayout)
+	{
+		NodeManager->Payloads[position] = NULL;
+		if (NodeArray != NULL)					// keeping an existing view in step
+		{
+			NodeArray[position].data = NULL;
+		}
+	}
+	else
+	{
+		NodeArray[position].data = NULL;
+	}
 
 	return true;
 }
 
 
-/* Testing (Feel Free To Delete) */
+/* LRU Cache */
 
-/*
-int main()
+static unsigned long long LRUHashKey(unsigned long long Key)	// mixes the key bits so sequential keys spread out over the hash table
 {
+	Key ^= Key >> 33;
+	Key *= 0xff51afd7ed558ccdULL;
+	Key ^= Key >> 33;
+	Key *= 0xc4ceb9fe1a85ec53ULL;
+	Key ^= Key >> 33;
 
-	struct NodeManager* List1Manager = CreateList(10, "List1");
-	if (List1Manager == NULL)
+	return Key;
+}
+
+
+static int LRUFindSlot(struct LRUCache* Cache, unsigned long long Key)	// returns the slot holding Key, or the empty slot where Key would go
+{
+	int slot = (int)(LRUHashKey(Key) & (unsigned long long)Cache->HashMask);
+
+	// probing until we hit the key or an empty slot (the table is at least twice the capacity so there is always an empty slot)
+	while (Cache->HashIndex[slot] != -1 && Cache->Keys[Cache->HashIndex[slot]] != Key)
 	{
-		printf("NULLLLL");
+		slot = (slot + 1) & Cache->HashMask;
 	}
-	int meh = 323;
-	SetNodeData(List1Manager, 2, &meh);
-	printf("Data for 2 is: %d\n", *(int*)List1Manager->NodeArray[2].data);
-	struct Node* NewEnd = InsertNodeAtEnd(List1Manager);
-	printf("Data for 2 is: %d\n", *(int*)List1Manager->NodeArray[2].data);
-	struct Node* NewBeg = InsertNodeAtBeginning(List1Manager);
-	printf("Data for 3 is: %d\n", *(int*)List1Manager->NodeArray[3].data);
-	struct Node* NewPos = InsertNodeAtPosition(List1Manager, 4);
-	printf("Data for 4 is: %d\n", *(int*)List1Manager->NodeArray[3].data);
-	printf("Position NewEnd is %d\n", NewEnd->position);
-	printf("Position NewBeg is %d\n", NewBeg->position);
-	printf("Position NewPos is %d\n", NewPos->position);
-	DeleteNodeAtEnd(List1Manager);
-	printf("Data for 3 is: %d\n", *(int*)List1Manager->NodeArray[3].data);
-	DeleteNodeAtBeginning(List1Manager);
-	printf("Data for 2 is: %d\n", *(int*)List1Manager->NodeArray[2].data);
-	DeleteNodeAtPosition(List1Manager, 1);
-	printf("Data for 1 is: %d\n", *(int*)List1Manager->NodeArray[1].data);
-	DeleteNodeAtPosition(List1Manager, 2);
-	printf("Data for 1 is: %d\n", *(int*)List1Manager->NodeArray[1].data);
-	InsertNodeAtPosition(List1Manager, 0);
-	printf("Data for 2 is: %d\n", *(int*)List1Manager->NodeArray[2].data);
 
+	return slot;
+}
 
-	printf("ListID is: %s\n", List1Manager->ListID);	
-	printf("NodeCount is: %d\n", List1Manager->NodeCount);
-	printf("Head (NodeManager) is: %d\n", List1Manager->head->position);
-	printf("Tail (NodeManager) is: %d\n", List1Manager->tail->position);
-	printf("Position 0 is %d\n", List1Manager->NodeArray[0].position);
-	printf("Position 0 (tail) is %d\n", List1Manager->NodeArray[10].next->position);
-	printf("Position 0 (prev) is %d\n", List1Manager->NodeArray[1].prev->position);
-	printf("Position 1 is %d\n", List1Manager->NodeArray[1].position);
-	printf("Position 1 (next) is %d\n", List1Manager->NodeArray[0].next->position);
-	printf("Position 1 (prev) is %d\n", List1Manager->NodeArray[2].prev->position);
-	printf("Position 2 is %d\n", List1Manager->NodeArray[2].position);
-	printf("Position 2 (next) is %d\n", List1Manager->NodeArray[1].next->position);
-	printf("Position 2 (prev) is %d\n", List1Manager->NodeArray[3].prev->position);
-	printf("Position 3 is %d\n", List1Manager->NodeArray[3].position);
-	printf("Position 3 (next) is %d\n", List1Manager->NodeArray[2].next->position);
-	printf("Position 3 (prev) is %d\n", List1Manager->NodeArray[4].prev->position);
-	printf("Position 4 is %d\n", List1Manager->NodeArray[4].position);
-	printf("Position 4 (next) is %d\n", List1Manager->NodeArray[3].next->position);
-	printf("Position 4 (prev) is %d\n", List1Manager->NodeArray[5].prev->position);
-	printf("Position 5 is %d\n", List1Manager->NodeArray[5].position);
-	printf("Position 5 (next) is %d\n", List1Manager->NodeArray[4].next->position);
-	printf("Position 5 (prev) is %d\n", List1Manager->NodeArray[6].prev->position);
-	printf("Position 6 is %d\n", List1Manager->NodeArray[6].position);
-	printf("Position 6 (next) is %d\n", List1Manager->NodeArray[5].next->position);
-	printf("Position 6 (prev) is %d\n", List1Manager->NodeArray[7].prev->position);
-	printf("Position 7 is %d\n", List1Manager->NodeArray[7].position);
-	printf("Position 7 (next) is %d\n", List1Manager->NodeArray[6].next->position);
-	printf("Position 7 (prev) is %d\n", List1Manager->NodeArray[8].prev->position);
-	printf("Position 8 is %d\n", List1Manager->NodeArray[8].position);
-	printf("Position 8 (next) is %d\n", List1Manager->NodeArray[7].next->position);
-	printf("Position 8 (prev) is %d\n", List1Manager->NodeArray[9].prev->position);
-	printf("Position 9 is %d\n", List1Manager->NodeArray[9].position);
-	printf("Position 9 (next) is %d\n", List1Manager->NodeArray[8].next->position);
-	printf("Position 9 (prev) is %d\n", List1Manager->NodeArray[10].prev->position);
-	printf("Position 10 is %d\n", List1Manager->NodeArray[10].position);
-	printf("Position 10 (next) is %d\n", List1Manager->NodeArray[9].next->position);
-	printf("Position 10 (prev) is %d\n", List1Manager->NodeArray[0].prev->position);
-	return 0;
+
+static void LRURemoveSlot(struct LRUCache* Cache, int slot)		// empties a slot, shifting later entries of the probe run back so lookups never need tombstones
+{
+	int hole = slot;
+
+	for (int i = (slot + 1) & Cache->HashMask; Cache->HashIndex[i] != -1; i = (i + 1) & Cache->HashMask)
+	{
+		int home = (int)(LRUHashKey(Cache->Keys[Cache->HashIndex[i]]) & (unsigned long long)Cache->HashMask);
+
+		// an entry can fill the hole if its home slot is not between the hole and where it currently sits
+		if (((i - home) & Cache->HashMask) >= ((i - hole) & Cache->HashMask))
+		{
+			Cache->HashIndex[hole] = Cache->HashIndex[i];
+			hole = i;
+		}
+	}
+
+	Cache->HashIndex[hole] = -1;
 }
 
-*/
+
+static void LRUPromoteNode(struct LRUCache* Cache, struct Node* Node)	// moves a node in front of head in O(1), making it the most recently used entry
+{
+	struct NodeManager* Manager = Cache->Manager;
+
+	if (Node == Manager->head)
+	{
+		return;
+	}
+
+	if (Node == Manager->tail)
+	{
+		Manager->tail = Node->prev;
+	}
+
+	// unlinking the node from where it currently sits
+	Node->prev->next = Node->next;
+	Node->next->prev = Node->prev;
+
+	// linking the node back in between head and the node before head
+	Node->prev = Manager->head->prev;
+	Node->next = Manager->head;
+	Manager->head->prev->next = Node;
+	Manager->head->prev = Node;
+	Manager->head = Node;
+}
+
+
+struct LRUCache* CreateLRUCache(int Capacity, const char* CacheID, LRUEvictionCallback EvictionCallback, void* CallbackContext)
+{
+	// error checking capacity
+	if (Capacity <= 0 || Capacity > (1 << 28))
+	{
+		fprintf(stderr, "\nInvalid Capacity\n");
+		return NULL;
+	}
+
+	// creating an instance of LRUCache called cache
+	struct LRUCache* cache = calloc(1, sizeof(struct LRUCache));
+
+	// error checking LRUCache
+	if (cache == NULL)
+	{
+		perror("Failed to allocate memory for LRUCache");
+		return NULL;
+	}
+
+	// the hash table is kept at least twice the capacity so probe runs stay short
+	int HashSize = 1;
+	while (HashSize < Capacity * 2)
+	{
+		HashSize <<= 1;
+	}
+
+	// creating the list and the key storage
+	cache->Manager = CreateList(Capacity, CacheID);
+	cache->Keys = calloc(Capacity, sizeof(unsigned long long));
+	cache->HashIndex = malloc(HashSize * sizeof(int));
+
+	// error checking our newly allocated memory
+	if (cache->Manager == NULL || cache->Keys == NULL || cache->HashIndex == NULL)
+	{
+		perror("Failed to allocate memory for LRUCache members");
+		if (cache->Manager != NULL)
+		{
+			DeleteList(cache->Manager);
+		}
+		free(cache->Keys);
+		free(cache->HashIndex);
+		free(cache);
+		return NULL;
+	}
+
+	// CreateList links the head forward to index 1 even when there is only one node, so closing the ring here
+	if (Capacity == 1)
+	{
+		cache->Manager->head->next = cache->Manager->head;
+		cache->Manager->head->prev = cache->Manager->head;
+	}
+
+	// initializing LRUCache variables
+	strncpy(cache->CacheID, CacheID, sizeof(cache->CacheID) - 1);
+	cache->CacheID[sizeof(cache->CacheID) - 1] = '\0';
+	cache->Capacity = Capacity;
+	cache->Count = 0;
+	cache->HashMask = HashSize - 1;
+	cache->EvictionCallback = EvictionCallback;
+	cache->CallbackContext = CallbackContext;
+	memset(cache->HashIndex, -1, HashSize * sizeof(int));		// every byte set to 0xFF makes every slot -1 (empty)
+
+
+	return cache;
+}
+
+
+struct Node* LRUGet(struct LRUCache* Cache, unsigned long long Key)
+{
+	// error checking passed in LRUCache pointer
+	if (Cache == NULL)
+	{
+		fprintf(stderr, "\nLRUCache in LRUGet Function is NULL\n");
+		return NULL;
+	}
+
+	int slot = LRUFindSlot(Cache, Key);
+
+	// a miss is a normal result for a cache so it is not reported
+	if (Cache->HashIndex[slot] == -1)
+	{
+		return NULL;
+	}
+
+	struct Node* Node = &Cache->Manager->NodeArray[Cache->HashIndex[slot]];
+	LRUPromoteNode(Cache, Node);
+
+	return Node;
+}
+
+
+struct Node* LRUPut(struct LRUCache* Cache, unsigned long long Key, void* data)
+{
+	// error checking passed in LRUCache pointer
+	if (Cache == NULL)
+	{
+		fprintf(stderr, "\nLRUCache in LRUPut Function is NULL\n");
+		return NULL;
+	}
+
+	struct NodeManager* Manager = Cache->Manager;
+	int slot = LRUFindSlot(Cache, Key);
+
+	// updating an existing key
+	if (Cache->HashIndex[slot] != -1)
+	{
+		struct Node* Node = &Manager->NodeArray[Cache->HashIndex[slot]];
+		Node->data = data;
+		LRUPromoteNode(Cache, Node);
+		return Node;
+	}
+
+	// making room, evicting shifts the probe run so the slot has to be found again
+	if (Cache->Count == Cache->Capacity)
+	{
+		LRUEvict(Cache);
+		slot = LRUFindSlot(Cache, Key);
+	}
+
+	// taking an unused node, the one right before head is always unused when the cache is not full
+	struct Node* Node;
+	if (Cache->Count == 0)
+	{
+		Node = Manager->head;
+		Manager->tail = Node;
+	}
+	else
+	{
+		Node = Manager->head->prev;
+		Manager->head = Node;
+	}
+
+	Node->data = data;
+	Cache->Keys[Node->position] = Key;
+	Cache->HashIndex[slot] = Node->position;
+	Cache->Count += 1;
+
+
+	return Node;
+}
+
+
+bool LRUEvict(struct LRUCache* Cache)
+{
+	// error checking passed in LRUCache pointer
+	if (Cache == NULL)
+	{
+		fprintf(stderr, "\nLRUCache in LRUEvict Function is NULL\n");
+		return false;
+	}
+
+	if (Cache->Count == 0)
+	{
+		fprintf(stderr, "\nLRUCache in LRUEvict Function is empty\n");
+		return false;
+	}
+
+	// the tail is the least recently used entry, once unused it simply becomes part of the unused run between tail and head
+	struct Node* Node = Cache->Manager->tail;
+	unsigned long long Key = Cache->Keys[Node->position];
+	void* data = Node->data;
+
+	LRURemoveSlot(Cache, LRUFindSlot(Cache, Key));
+	Node->data = NULL;
+	Cache->Count -= 1;
+	if (Cache->Count > 0)
+	{
+		Cache->Manager->tail = Node->prev;
+	}
+
+	if (Cache->EvictionCallback != NULL)
+	{
+		Cache->EvictionCallback(Key, data, Cache->CallbackContext);
+	}
+
+
+	return true;
+}
+
+
+bool DeleteLRUCache(struct LRUCache* Cache)
+{
+	// error checking passed in LRUCache pointer
+	if (Cache == NULL)
+	{
+		fprintf(stderr, "\nLRUCache in DeleteLRUCache Function is NULL\n");
+		return false;
+	}
+
+	// freeing the list, key storage and the cache itself
+	DeleteList(Cache->Manager);
+	free(Cache->Keys);
+	free(Cache->HashIndex);
+	free(Cache);
+
+	return true;
+}
+
+
+/* List Batches */
+
+struct ListBatch* BeginListBatch(struct NodeManager* NodeManager)
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in BeginListBatch Function is NULL\n");
+		return NULL;
+	}
+
+	// creating an instance of ListBatch called batch
+	struct ListBatch* batch = calloc(1, sizeof(struct ListBatch));
+
+	// error checking ListBatch
+	if (batch == NULL)
+	{
+		perror("Failed to allocate memory for ListBatch");
+		return NULL;
+	}
+
+	batch->Manager = NodeManager;
+	batch->NodeCount = NodeManager->NodeCount;
+	batch->Modifications = NodeManager->Modifications;
+
+	return batch;
+}
+
+
+static bool QueueListBatchOperation(struct ListBatch* Batch, int position, bool insert, void* data)	// appends an operation to the batch queue, doubling the queue when it is full
+{
+	if (Batch->OperationCount == Batch->OperationCapacity)
+	{
+		int NewCapacity = Batch->OperationCapacity == 0 ? 16 : Batch->OperationCapacity * 2;
+		struct ListBatchOperation* TempOperations = realloc(Batch->Operations, NewCapacity * sizeof(struct ListBatchOperation));
+
+		// error checking our newly allocated memory
+		if (TempOperations == NULL)
+		{
+			perror("Failed to allocate memory for TempOperations");
+			return false;
+		}
+
+		Batch->Operations = TempOperations;
+		Batch->OperationCapacity = NewCapacity;
+	}
+
+	struct ListBatchOperation* operation = &Batch->Operations[Batch->OperationCount];
+	operation->position = position;
+	operation->sequence = Batch->OperationCount;
+	operation->insert = insert;
+	operation->data = data;
+	Batch->OperationCount += 1;
+
+	return true;
+}
+
+
+bool BatchInsertNode(struct ListBatch* Batch, int position, void* data)
+{
+	// error checking passed in ListBatch pointer
+	if (Batch == NULL)
+	{
+		fprintf(stderr, "\nListBatch in BatchInsertNode Function is NULL\n");
+		return false;
+	}
+
+	// inserting at NodeCount appends after the pre-batch tail
+	if (position < 0 || position > Batch->NodeCount)
+	{
+		fprintf(stderr, "\nPosition arguement is out of bounds\n");
+		return false;
+	}
+
+	return QueueListBatchOperation(Batch, position, true, data);
+}
+
+
+bool BatchDeleteNode(struct ListBatch* Batch, int position)
+{
+	// error checking passed in ListBatch pointer
+	if (Batch == NULL)
+	{
+		fprintf(stderr, "\nListBatch in BatchDeleteNode Function is NULL\n");
+		return false;
+	}
+
+	if (position < 0 || position > Batch->NodeCount - 1)
+	{
+		fprintf(stderr, "\nPosition arguement is out of bounds\n");
+		return false;
+	}
+
+	return QueueListBatchOperation(Batch, position, false, NULL);
+}
+
+
+static int CompareListBatchOperations(const void* a, const void* b)	// orders by position, then inserts before deletes, then queue order so same position inserts keep the order they were queued in
+{
+	const struct ListBatchOperation* left = a;
+	const struct ListBatchOperation* right = b;
+
+	if (left->position != right->position)
+	{
+		return left->position < right->position ? -1 : 1;
+	}
+	if (left->insert != right->insert)
+	{
+		return left->insert ? -1 : 1;
+	}
+
+	return left->sequence < right->sequence ? -1 : (left->sequence > right->sequence);
+}
+
+
+bool CancelListBatch(struct ListBatch* Batch)
+{
+	// error checking passed in ListBatch pointer
+	if (Batch == NULL)
+	{
+		fprintf(stderr, "\nListBatch in CancelListBatch Function is NULL\n");
+		return false;
+	}
+
+	// freeing the queue and the batch without touching the list
+	free(Batch->Operations);
+	free(Batch);
+
+	return true;
+}
+
+
+static bool CommitSplitListBatch(struct ListBatch* Batch, int NewNodeCount)	// the split layout version of the merge in CommitListBatch, the operations are already sorted and checked
+{
+	// setting local variables to the batch's NodeManager, NodeCount and Payloads for readability
+	struct NodeManager* NodeManager = Batch->Manager;
+	int NodeCount = NodeManager->NodeCount;
+	void** Payloads = NodeManager->Payloads;
+	struct ListBatchOperation* Operations = Batch->Operations;
+	int OperationCount = Batch->OperationCount;
+
+	// allocating the new payload array once for the whole batch
+	void** NewPayloads = malloc(NewNodeCount * sizeof(void*));
+
+	// error checking our newly allocated memory
+	if (NewPayloads == NULL)
+	{
+		perror("Failed to allocate memory for NewPayloads");
+		CancelListBatch(Batch);
+		return false;
+	}
+
+	// merging the sorted operations with the old payloads in a single pass
+	int operation = 0;
+	int NewPosition = 0;
+	for (int i = 0; i <= NodeCount; i++)
+	{
+		// inserts queued at position i go in front of old node i (or after the tail when i is NodeCount)
+		while (operation < OperationCount && Operations[operation].position == i && Operations[operation].insert)
+		{
+			NewPayloads[NewPosition] = Operations[operation].data;
+			NewPosition += 1;
+			operation += 1;
+		}
+
+		if (i == NodeCount)
+		{
+			break;
+		}
+
+		// skipping old node i if it was deleted
+		if (operation < OperationCount && Operations[operation].position == i)
+		{
+			operation += 1;
+			continue;
+		}
+
+		NewPayloads[NewPosition] = Payloads[i];
+		NewPosition += 1;
+	}
+
+	// swapping the new payloads into the NodeManager, links and positions follow from the index
+	free(Payloads);
+	NodeManager->Payloads = NewPayloads;
+	NodeManager->NodeCount = NewNodeCount;
+	NodeManager->Modifications += 1;
+	ReleaseNodeView(NodeManager);
+
+	// freeing the queue and the batch now that it has been applied
+	free(Batch->Operations);
+	free(Batch);
+
+
+	return true;
+}
+
+
+bool CommitListBatch(struct ListBatch* Batch)
+{
+	// error checking passed in ListBatch pointer
+	if (Batch == NULL)
+	{
+		fprintf(stderr, "\nListBatch in CommitListBatch Function is NULL\n");
+		return false;
+	}
+
+	// setting local variables to the batch's NodeManager, NodeCount and NodeArray for readability
+	struct NodeManager* NodeManager = Batch->Manager;
+	int NodeCount = NodeManager->NodeCount;
+	struct Node* NodeArray = NodeManager->NodeArray;
+	struct ListBatchOperation* Operations = Batch->Operations;
+	int OperationCount = Batch->OperationCount;
+
+	// the positions were checked against the list as it was when the batch began
+	if (NodeManager->Modifications != Batch->Modifications)
+	{
+		fprintf(stderr, "\nList in CommitListBatch Function changed since BeginListBatch\n");
+		CancelListBatch(Batch);
+		return false;
+	}
+
+	if (OperationCount > 0)
+	{
+		qsort(Operations, OperationCount, sizeof(struct ListBatchOperation), CompareListBatchOperations);
+	}
+
+	// counting the new size and rejecting a node being deleted twice
+	int NewNodeCount = NodeCount;
+	for (int i = 0; i < OperationCount; i++)
+	{
+		if (Operations[i].insert)
+		{
+			NewNodeCount += 1;
+		}
+		else if (i > 0 && !Operations[i - 1].insert && Operations[i - 1].position == Operations[i].position)
+		{
+			fprintf(stderr, "\nNode %d is deleted more than once in CommitListBatch Function\n", Operations[i].position);
+			CancelListBatch(Batch);
+			return false;
+		}
+		else if (NodeManager->LazyDelete && NodeManager->Generations[Operations[i].position] == 0)
+		{
+			fprintf(stderr, "\nNode %d in CommitListBatch Function is already deleted\n", Operations[i].position);
+			CancelListBatch(Batch);
+			return false;
+		}
+		else
+		{
+			NewNodeCount -= 1;
+		}
+	}
+
+	if (NewNodeCount - NodeManager->TombstoneCount <= 0)
+	{
+		fprintf(stderr, "\nCommitListBatch Function would leave the list empty\n");
+		CancelListBatch(Batch);
+		return false;
+	}
+
+	// split layout lists merge their payload array instead
+	if (NodeManager->SplitLayout)
+	{
+		return CommitSplitListBatch(Batch, NewNodeCount);
+	}
+
+	// allocating the new node array once for the whole batch
+	struct Node* NewNodeArray = calloc(NewNodeCount, sizeof(struct Node));
+
+	// error checking our newly allocated memory
+	if (NewNodeArray == NULL)
+	{
+		perror("Failed to allocate memory for NewNodeArray");
+		CancelListBatch(Batch);
+		return false;
+	}
+
+	// lazy delete lists also get new generations, old nodes and tombstones keep theirs
+	unsigned int* Generations = NodeManager->Generations;
+	unsigned int* NewGenerations = NULL;
+	if (NodeManager->LazyDelete)
+	{
+		NewGenerations = malloc(NewNodeCount * sizeof(unsigned int));
+
+		// error checking our newly allocated memory
+		if (NewGenerations == NULL)
+		{
+			perror("Failed to allocate memory for NewGenerations");
+			free(NewNodeArray);
+			CancelListBatch(Batch);
+			return false;
+		}
+	}
+
+	// merging the sorted operations with the old nodes in a single pass
+	int operation = 0;
+	int NewPosition = 0;
+	for (int i = 0; i <= NodeCount; i++)
+	{
+		// inserts queued at position i go in front of old node i (or after the tail when i is NodeCount)
+		while (operation < OperationCount && Operations[operation].position == i && Operations[operation].insert)
+		{
+			NewNodeArray[NewPosition].data = Operations[operation].data;
+			if (NewGenerations != NULL)
+			{
+				NewGenerations[NewPosition] = NewGeneration(NodeManager);
+			}
+			NewPosition += 1;
+			operation += 1;
+		}
+
+		if (i == NodeCount)
+		{
+			break;
+		}
+
+		// skipping old node i if it was deleted
+		if (operation < OperationCount && Operations[operation].position == i)
+		{
+			operation += 1;
+			continue;
+		}
+
+		NewNodeArray[NewPosition].data = NodeArray[i].data;
+		if (NewGenerations != NULL)
+		{
+			NewGenerations[NewPosition] = Generations[i];
+		}
+		NewPosition += 1;
+	}
+
+	// swapping the new array into the NodeManager
+	free(NodeArray);
+	NodeManager->NodeArray = NewNodeArray;
+	NodeManager->NodeCount = NewNodeCount;
+	NodeManager->Modifications += 1;
+
+	// setting links and positions once for the new array, lazy delete lists link around their tombstones
+	if (NewGenerations != NULL)
+	{
+		free(Generations);
+		NodeManager->Generations = NewGenerations;
+		RelinkLazyList(NodeManager);
+	}
+	else
+	{
+		for (int i = 0; i < NewNodeCount; i++)
+		{
+			NewNodeArray[i].position = i;
+			NewNodeArray[i].next = &NewNodeArray[(i + 1) % NewNodeCount];
+			NewNodeArray[i].prev = &NewNodeArray[(i + NewNodeCount - 1) % NewNodeCount];
+		}
+		NodeManager->head = &NewNodeArray[0];
+		NodeManager->tail = &NewNodeArray[NewNodeCount - 1];
+	}
+
+	// freeing the queue and the batch now that it has been applied
+	free(Batch->Operations);
+	free(Batch);
+
+	// the batch kept every old tombstone, so it gets the same compaction check as a single lazy delete
+	if (NodeManager->LazyDelete && NodeManager->TombstoneCount > NodeManager->CompactRatio * NodeManager->NodeCount)
+	{
+		return CompactList(NodeManager);
+	}
+
+
+	return true;
+}
+
+
+/* Lazy Deletes */
+
+static unsigned int NewGeneration(struct NodeManager* NodeManager)	// hands out the next generation, skipping 0 because 0 marks a tombstone
+{
+	NodeManager->NextGeneration += 1;
+	if (NodeManager->NextGeneration == 0)
+	{
+		NodeManager->NextGeneration = 1;
+	}
+
+	return NodeManager->NextGeneration;
+}
+
+
+bool EnableLazyDelete(struct NodeManager* NodeManager, double CompactRatio)
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in EnableLazyDelete Function is NULL\n");
+		return false;
+	}
+
+	// error checking the compaction ratio
+	if (CompactRatio <= 0.0 || CompactRatio > 1.0)
+	{
+		fprintf(stderr, "\nInvalid CompactRatio\n");
+		return false;
+	}
+
+	if (NodeManager->SplitLayout)
+	{
+		fprintf(stderr, "\nEnableLazyDelete Function does not support split layout lists\n");
+		return false;
+	}
+
+	// allocating a generation for every node if this is the first time lazy deletes are turned on
+	if (!NodeManager->LazyDelete)
+	{
+		unsigned int* Generations = malloc(NodeManager->NodeCount * sizeof(unsigned int));
+
+		// error checking our newly allocated memory
+		if (Generations == NULL)
+		{
+			perror("Failed to allocate memory for Generations");
+			return false;
+		}
+
+		NodeManager->Generations = Generations;
+		for (int i = 0; i < NodeManager->NodeCount; i++)
+		{
+			Generations[i] = NewGeneration(NodeManager);
+		}
+		NodeManager->TombstoneCount = 0;
+		NodeManager->LazyDelete = true;
+	}
+
+	NodeManager->CompactRatio = CompactRatio;
+
+	return true;
+}
+
+
+bool DisableLazyDelete(struct NodeManager* NodeManager)
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in DisableLazyDelete Function is NULL\n");
+		return false;
+	}
+
+	// removing every tombstone before going back to compacting on each delete
+	if (!CompactList(NodeManager))
+	{
+		return false;
+	}
+
+	// freeing the generations, every handle to this list is stale from here on
+	free(NodeManager->Generations);
+	NodeManager->Generations = NULL;
+	NodeManager->LazyDelete = false;
+
+	return true;
+}
+
+
+static bool TombstoneNode(struct NodeManager* NodeManager, int position)	// unlinks a node in O(1) and marks it deleted, compacting once there are too many tombstones
+{
+	// error checking position value
+	if (position < 0 || position > NodeManager->NodeCount - 1)
+	{
+		fprintf(stderr, "\nPosition arguement is out of bounds\n");
+		return false;
+	}
+
+	if (NodeManager->Generations[position] == 0)
+	{
+		fprintf(stderr, "\nNode at position %d is already deleted\n", position);
+		return false;
+	}
+
+	// a list always keeps at least one node
+	if (NodeManager->NodeCount - NodeManager->TombstoneCount == 1)
+	{
+		fprintf(stderr, "\nCannot delete the last node in the list\n");
+		return false;
+	}
+
+	// unlinking the node so traversal skips it
+	struct Node* Node = &NodeManager->NodeArray[position];
+	Node->prev->next = Node->next;
+	Node->next->prev = Node->prev;
+	if (NodeManager->head == Node)
+	{
+		NodeManager->head = Node->next;
+	}
+	if (NodeManager->tail == Node)
+	{
+		NodeManager->tail = Node->prev;
+	}
+
+	// marking the node as a tombstone, this makes every handle to it stale, its links are cleared so nothing can follow them into a later realloc
+	Node->data = NULL;
+	Node->next = NULL;
+	Node->prev = NULL;
+	NodeManager->Generations[position] = 0;
+	NodeManager->TombstoneCount += 1;
+
+	if (NodeManager->TombstoneCount > NodeManager->CompactRatio * NodeManager->NodeCount)
+	{
+		return CompactList(NodeManager);
+	}
+
+	return true;
+}
+
+
+static void RelinkLazyList(struct NodeManager* NodeManager)	// renumbers every slot and links the live nodes in array order, skipping tombstones
+{
+	struct Node* NodeArray = NodeManager->NodeArray;
+	unsigned int* Generations = NodeManager->Generations;
+	int first = -1;
+	int last = -1;
+
+	for (int i = 0; i < NodeManager->NodeCount; i++)
+	{
+		NodeArray[i].position = i;
+		if (Generations[i] == 0)
+		{
+			NodeArray[i].next = NULL;
+			NodeArray[i].prev = NULL;
+			continue;
+		}
+
+		if (last == -1)
+		{
+			first = i;
+		}
+		else
+		{
+			NodeArray[last].next = &NodeArray[i];
+			NodeArray[i].prev = &NodeArray[last];
+		}
+		last = i;
+	}
+
+	// closing the ring
+	NodeArray[last].next = &NodeArray[first];
+	NodeArray[first].prev = &NodeArray[last];
+	NodeManager->head = &NodeArray[first];
+	NodeManager->tail = &NodeArray[last];
+}
+
+
+static struct Node* InsertLazyNode(struct NodeManager* NodeManager, int position)	// inserts a node at a NodeArray index, shifting live nodes and tombstones together with their generations
+{
+	// setting local variables to NodeManager's NodeCount for readability
+	int NodeCount = NodeManager->NodeCount;
+
+	if (position < 0 || position > NodeCount)
+	{
+		fprintf(stderr, "\nPosition arguement is out of bounds\n");
+		return NULL;
+	}
+
+	// reallocating memory for the new node. Generations goes first because nothing points into it, so if the NodeArray realloc then fails
+	// the only effect is a spare generation slot, while a moved NodeArray would leave head, tail and every link pointing at the freed block
+	unsigned int* TempGenerations = realloc(NodeManager->Generations, (NodeCount + 1) * sizeof(unsigned int));
+	if (TempGenerations == NULL)
+	{
+		perror("Failed to allocate memory for TempGenerations");
+		return NULL;
+	}
+	NodeManager->Generations = TempGenerations;
+
+	struct Node* TempNodeArray = realloc(NodeManager->NodeArray, (NodeCount + 1) * sizeof(struct Node));
+	if (TempNodeArray == NULL)
+	{
+		perror("Failed to allocate memory for TempNodeArray");
+		return NULL;
+	}
+	NodeManager->NodeArray = TempNodeArray;
+
+	// shifting every slot after position up by one, the generations move with their nodes
+	memmove(&TempNodeArray[position + 1], &TempNodeArray[position], (NodeCount - position) * sizeof(struct Node));
+	memmove(&TempGenerations[position + 1], &TempGenerations[position], (NodeCount - position) * sizeof(unsigned int));
+	TempNodeArray[position].data = NULL;
+	TempGenerations[position] = NewGeneration(NodeManager);
+
+	NodeManager->NodeCount += 1;
+	RelinkLazyList(NodeManager);
+
+
+	return &TempNodeArray[position];
+}
+
+
+bool CompactList(struct NodeManager* NodeManager)
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in CompactList Function is NULL\n");
+		return false;
+	}
+
+	// nothing to compact
+	if (!NodeManager->LazyDelete || NodeManager->TombstoneCount == 0)
+	{
+		return true;
+	}
+
+	// setting local variables to NodeManager's NodeCount, NodeArray and Generations for readability
+	int NodeCount = NodeManager->NodeCount;
+	struct Node* NodeArray = NodeManager->NodeArray;
+	unsigned int* Generations = NodeManager->Generations;
+
+	// sliding live nodes down over the tombstones, nodes that move get a new generation so old handles to them go stale
+	int LiveCount = 0;
+	for (int i = 0; i < NodeCount; i++)
+	{
+		if (Generations[i] == 0)
+		{
+			continue;
+		}
+
+		if (LiveCount != i)
+		{
+			NodeArray[LiveCount].data = NodeArray[i].data;
+			Generations[LiveCount] = NewGeneration(NodeManager);
+		}
+		LiveCount += 1;
+	}
+
+	// shrinking memory, a failed shrink keeps the larger blocks which are still valid
+	struct Node* TempNodeArray = realloc(NodeArray, LiveCount * sizeof(struct Node));
+	if (TempNodeArray != NULL)
+	{
+		NodeArray = TempNodeArray;
+	}
+	unsigned int* TempGenerations = realloc(Generations, LiveCount * sizeof(unsigned int));
+	if (TempGenerations != NULL)
+	{
+		Generations = TempGenerations;
+	}
+
+	// updating NodeManager variables
+	NodeManager->NodeArray = NodeArray;
+	NodeManager->Generations = Generations;
+	NodeManager->NodeCount = LiveCount;
+	NodeManager->TombstoneCount = 0;
+	NodeManager->Modifications += 1;
+	NodeManager->head = &NodeArray[0];
+	NodeManager->tail = &NodeArray[LiveCount - 1];
+
+	// relinking every node in case of a new memory block
+	for (int i = 0; i < LiveCount; i++)
+	{
+		NodeArray[i].position = i;
+		NodeArray[i].next = &NodeArray[(i + 1) % LiveCount];
+		NodeArray[i].prev = &NodeArray[(i + LiveCount - 1) % LiveCount];
+	}
+
+
+	return true;
+}
+
+
+struct NodeHandle GetNodeHandle(struct NodeManager* NodeManager, int position)
+{
+	struct NodeHandle handle = { -1, 0 };
+
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in GetNodeHandle Function is NULL\n");
+		return handle;
+	}
+
+	if (!NodeManager->LazyDelete)
+	{
+		fprintf(stderr, "\nGetNodeHandle Function needs lazy deletes to be enabled\n");
+		return handle;
+	}
+
+	// error checking position value
+	if (position < 0 || position > NodeManager->NodeCount - 1 || NodeManager->Generations[position] == 0)
+	{
+		fprintf(stderr, "\nPosition arguement is out of bounds\n");
+		return handle;
+	}
+
+	handle.position = position;
+	handle.generation = NodeManager->Generations[position];
+
+	return handle;
+}
+
+
+struct Node* ResolveNodeHandle(struct NodeManager* NodeManager, struct NodeHandle Handle)
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in ResolveNodeHandle Function is NULL\n");
+		return NULL;
+	}
+
+	// a stale handle is an expected result so it is not reported
+	if (!NodeManager->LazyDelete || Handle.position < 0 || Handle.position > NodeManager->NodeCount - 1)
+	{
+		return NULL;
+	}
+	if (Handle.generation == 0 || NodeManager->Generations[Handle.position] != Handle.generation)
+	{
+		return NULL;
+	}
+
+	return &NodeManager->NodeArray[Handle.position];
+}
+
+
+/* Split Layout */
+
+struct NodeManager* CreateSplitList(int NodeCount, const char* ListID)
+{
+	// error checking node count
+	if (NodeCount <= 0)
+	{
+		fprintf(stderr, "\nInvalid NodeCount\n");
+		return NULL;
+	}
+
+	// creating an instance of NodeManager called manager
+	struct NodeManager* manager = calloc(1, sizeof(struct NodeManager));
+
+	// error checking NodeManager
+	if (manager == NULL)
+	{
+		perror("Failed to allocate memory for NodeManager");
+		return NULL;
+	}
+
+	// creating the payload array, links and positions follow from the index so they are not stored
+	manager->Payloads = calloc(NodeCount, sizeof(void*));
+
+	// error checking our newly allocated memory
+	if (manager->Payloads == NULL)
+	{
+		perror("Failed to allocate memory for Payloads");
+		free(manager);
+		return NULL;
+	}
+
+	// initializing NodeManager variables, NodeArray, head and tail stay NULL until GetNodeView builds the view
+	strncpy(manager->ListID, ListID, sizeof(manager->ListID) - 1);
+	manager->ListID[sizeof(manager->ListID) - 1] = '\0';
+	manager->NodeCount = NodeCount;
+	manager->SplitLayout = true;
+
+
+	return manager;
+}
+
+
+int InsertSplitNode(struct NodeManager* NodeManager, int position, void* data)
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in InsertSplitNode Function is NULL\n");
+		return -1;
+	}
+
+	if (!NodeManager->SplitLayout)
+	{
+		fprintf(stderr, "\nInsertSplitNode Function needs a list made by CreateSplitList\n");
+		return -1;
+	}
+
+	// setting local variables to NodeManager's NodeCount for readability
+	int NodeCount = NodeManager->NodeCount;
+
+	if (position < 0 || position > NodeCount)
+	{
+		fprintf(stderr, "\nPosition arguement is out of bounds\n");
+		return -1;
+	}
+
+	// reallocating memory for the new node
+	void** TempPayloads = realloc(NodeManager->Payloads, (NodeCount + 1) * sizeof(void*));
+
+	// error checking our newly allocated memory
+	if (TempPayloads == NULL)
+	{
+		perror("Failed to allocate memory for TempPayloads");
+		return -1;
+	}
+
+	// shifting the payloads after position, nothing else has to move
+	memmove(&TempPayloads[position + 1], &TempPayloads[position], (NodeCount - position) * sizeof(void*));
+	TempPayloads[position] = data;
+
+	NodeManager->Payloads = TempPayloads;
+	NodeManager->NodeCount += 1;
+	NodeManager->Modifications += 1;
+	ReleaseNodeView(NodeManager);
+
+
+	return position;
+}
+
+
+bool DeleteSplitNode(struct NodeManager* NodeManager, int position)
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in DeleteSplitNode Function is NULL\n");
+		return false;
+	}
+
+	if (!NodeManager->SplitLayout)
+	{
+		fprintf(stderr, "\nDeleteSplitNode Function needs a list made by CreateSplitList\n");
+		return false;
+	}
+
+	// setting local variables to NodeManager's NodeCount for readability
+	int NodeCount = NodeManager->NodeCount;
+
+	if (position < 0 || position > NodeCount - 1)
+	{
+		fprintf(stderr, "\nPosition arguement is out of bounds\n");
+		return false;
+	}
+
+	// a list always keeps at least one node
+	if (NodeCount == 1)
+	{
+		fprintf(stderr, "\nCannot delete the last node in the list\n");
+		return false;
+	}
+
+	// shifting the payloads after position
+	memmove(&NodeManager->Payloads[position], &NodeManager->Payloads[position + 1], (NodeCount - position - 1) * sizeof(void*));
+
+	NodeManager->NodeCount -= 1;
+	NodeManager->Modifications += 1;
+	ReleaseNodeView(NodeManager);
+
+	// shrinking memory, a failed shrink keeps the larger block which is still valid
+	void** TempPayloads = realloc(NodeManager->Payloads, NodeManager->NodeCount * sizeof(void*));
+	if (TempPayloads != NULL)
+	{
+		NodeManager->Payloads = TempPayloads;
+	}
+
+
+	return true;
+}
+
+
+const struct Node* GetNodeView(struct NodeManager* NodeManager, int position)	// the node is const, write data with SetNodeData, for split lists the view is a copy that the next insert, delete or batch commit frees
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in GetNodeView Function is NULL\n");
+		return NULL;
+	}
+
+	// error checking position value
+	if (position < 0 || position > NodeManager->NodeCount - 1)
+	{
+		fprintf(stderr, "\nPosition arguement is out of bounds\n");
+		return NULL;
+	}
+
+	// tombstones are no longer part of the list
+	if (NodeManager->LazyDelete && NodeManager->Generations[position] == 0)
+	{
+		fprintf(stderr, "\nNode at position %d is deleted\n", position);
+		return NULL;
+	}
+
+	// building the view of a split list if it does not exist yet
+	if (NodeManager->SplitLayout && NodeManager->NodeArray == NULL)
+	{
+		int NodeCount = NodeManager->NodeCount;
+		struct Node* NodeArray = malloc(NodeCount * sizeof(struct Node));
+
+		// error checking our newly allocated memory
+		if (NodeArray == NULL)
+		{
+			perror("Failed to allocate memory for NodeArray");
+			return NULL;
+		}
+
+		for (int i = 0; i < NodeCount; i++)
+		{
+			NodeArray[i].data = NodeManager->Payloads[i];
+			NodeArray[i].position = i;
+			NodeArray[i].next = &NodeArray[(i + 1) % NodeCount];
+			NodeArray[i].prev = &NodeArray[(i + NodeCount - 1) % NodeCount];
+		}
+
+		NodeManager->NodeArray = NodeArray;
+		NodeManager->head = &NodeArray[0];
+		NodeManager->tail = &NodeArray[NodeCount - 1];
+	}
+
+	return &NodeManager->NodeArray[position];
+}
+
+
+bool ReleaseNodeView(struct NodeManager* NodeManager)
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in ReleaseNodeView Function is NULL\n");
+		return false;
+	}
+
+	// only split lists have a view, for other lists NodeArray is the list itself
+	if (NodeManager->SplitLayout)
+	{
+		free(NodeManager->NodeArray);
+		NodeManager->NodeArray = NULL;
+		NodeManager->head = NULL;
+		NodeManager->tail = NULL;
+	}
+
+	return true;
+}
+
+
+void* GetNodeData(struct NodeManager* NodeManager, int position)
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in GetNodeData Function is NULL\n");
+		return NULL;
+	}
+
+	// error checking position value
+	if (position < 0 || position > NodeManager->NodeCount - 1)
+	{
+		fprintf(stderr, "\nPosition arguement is out of bounds\n");
+		return NULL;
+	}
+
+	// tombstones are no longer part of the list
+	if (NodeManager->LazyDelete && NodeManager->Generations[position] == 0)
+	{
+		fprintf(stderr, "\nNode at position %d is deleted\n", position);
+		return NULL;
+	}
+
+	if (NodeManager->SplitLayout)
+	{
+		return NodeManager->Payloads[position];
+	}
+
+	return NodeManager->NodeArray[position].data;
+}
+
+
+int GetNextPosition(struct NodeManager* NodeManager, int position)
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in GetNextPosition Function is NULL\n");
+		return -1;
+	}
+
+	// error checking position value
+	if (position < 0 || position > NodeManager->NodeCount - 1)
+	{
+		fprintf(stderr, "\nPosition arguement is out of bounds\n");
+		return -1;
+	}
+
+	// tombstones are no longer part of the list
+	if (NodeManager->LazyDelete && NodeManager->Generations[position] == 0)
+	{
+		fprintf(stderr, "\nNode at position %d is deleted\n", position);
+		return -1;
+	}
+
+	// split lists are always in array order so the link is computed instead of loaded
+	if (NodeManager->SplitLayout)
+	{
+		return (position + 1) % NodeManager->NodeCount;
+	}
+
+	return NodeManager->NodeArray[position].next->position;
+}
+
+
+int GetPrevPosition(struct NodeManager* NodeManager, int position)
+{
+	// error checking passed in NodeManager pointer
+	if (NodeManager == NULL)
+	{
+		fprintf(stderr, "\nNodeManager in GetPrevPosition Function is NULL\n");
+		return -1;
+	}
+
+	// error checking position value
+	if (position < 0 || position > NodeManager->NodeCount - 1)
+	{
+		fprintf(stderr, "\nPosition arguement is out of bounds\n");
+		return -1;
+	}
+
+	// tombstones are no longer part of the list
+	if (NodeManager->LazyDelete && NodeManager->Generations[position] == 0)
+	{
+		fprintf(stderr, "\nNode at position %d is deleted\n", position);
+		return -1;
+	}
+
+	// split lists are always in array order so the link is computed instead of loaded
+	if (NodeManager->SplitLayout)
+	{
+		return (position + NodeManager->NodeCount - 1) % NodeManager->NodeCount;
+	}
+
+	return NodeManager->NodeArray[position].prev->position;
+}
+
+
+/* Testing (Feel Free To Delete) */
+
+/*
+int main()
+{
+
+	struct NodeManager* List1Manager = CreateList(10, "List1");
+	if (List1Manager == NULL)
+	{
+		printf("NULLLLL");
+	}
+	int meh = 323;
+	SetNodeData(List1Manager, 2, &meh);
+	printf("Data for 2 is: %d\n", *(int*)List1Manager->NodeArray[2].data);
+	struct Node* NewEnd = InsertNodeAtEnd(List1Manager);
+	printf("Data for 2 is: %d\n", *(int*)List1Manager->NodeArray[2].data);
+	struct Node* NewBeg = InsertNodeAtBeginning(List1Manager);
+	printf("Data for 3 is: %d\n", *(int*)List1Manager->NodeArray[3].data);
+	struct Node* NewPos = InsertNodeAtPosition(List1Manager, 4);
+	printf("Data for 4 is: %d\n", *(int*)List1Manager->NodeArray[3].data);
+	printf("Position NewEnd is %d\n", NewEnd->position);
+	printf("Position NewBeg is %d\n", NewBeg->position);
+	printf("Position NewPos is %d\n", NewPos->position);
+	DeleteNodeAtEnd(List1Manager);
+	printf("Data for 3 is: %d\n", *(int*)List1Manager->NodeArray[3].data);
+	DeleteNodeAtBeginning(List1Manager);
+	printf("Data for 2 is: %d\n", *(int*)List1Manager->NodeArray[2].data);
+	DeleteNodeAtPosition(List1Manager, 1);
+	printf("Data for 1 is: %d\n", *(int*)List1Manager->NodeArray[1].data);
+	DeleteNodeAtPosition(List1Manager, 2);
+	printf("Data for 1 is: %d\n", *(int*)List1Manager->NodeArray[1].data);
+	InsertNodeAtPosition(List1Manager, 0);
+	printf("Data for 2 is: %d\n", *(int*)List1Manager->NodeArray[2].data);
+
+
+	printf("ListID is: %s\n", List1Manager->ListID);	
+	printf("NodeCount is: %d\n", List1Manager->NodeCount);
+	printf("Head (NodeManager) is: %d\n", List1Manager->head->position);
+	printf("Tail (NodeManager) is: %d\n", List1Manager->tail->position);
+	printf("Position 0 is %d\n", List1Manager->NodeArray[0].position);
+	printf("Position 0 (tail) is %d\n", List1Manager->NodeArray[10].next->position);
+	printf("Position 0 (prev) is %d\n", List1Manager->NodeArray[1].prev->position);
+	printf("Position 1 is %d\n", List1Manager->NodeArray[1].position);
+	printf("Position 1 (next) is %d\n", List1Manager->NodeArray[0].next->position);
+	printf("Position 1 (prev) is %d\n", List1Manager->NodeArray[2].prev->position);
+	printf("Position 2 is %d\n", List1Manager->NodeArray[2].position);
+	printf("Position 2 (next) is %d\n", List1Manager->NodeArray[1].next->position);
+	printf("Position 2 (prev) is %d\n", List1Manager->NodeArray[3].prev->position);
+	printf("Position 3 is %d\n", List1Manager->NodeArray[3].position);
+	printf("Position 3 (next) is %d\n", List1Manager->NodeArray[2].next->position);
+	printf("Position 3 (prev) is %d\n", List1Manager->NodeArray[4].prev->position);
+	printf("Position 4 is %d\n", List1Manager->NodeArray[4].position);
+	printf("Position 4 (next) is %d\n", List1Manager->NodeArray[3].next->position);
+	printf("Position 4 (prev) is %d\n", List1Manager->NodeArray[5].prev->position);
+	printf("Position 5 is %d\n", List1Manager->NodeArray[5].position);
+	printf("Position 5 (next) is %d\n", List1Manager->NodeArray[4].next->position);
+	printf("Position 5 (prev) is %d\n", List1Manager->NodeArray[6].prev->position);
+	printf("Position 6 is %d\n", List1Manager->NodeArray[6].position);
+	printf("Position 6 (next) is %d\n", List1Manager->NodeArray[5].next->position);
+	printf("Position 6 (prev) is %d\n", List1Manager->NodeArray[7].prev->position);
+	printf("Position 7 is %d\n", List1Manager->NodeArray[7].position);
+	printf("Position 7 (next) is %d\n", List1Manager->NodeArray[6].next->position);
+	printf("Position 7 (prev) is %d\n", List1Manager->NodeArray[8].prev->position);
+	printf("Position 8 is %d\n", List1Manager->NodeArray[8].position);
+	printf("Position 8 (next) is %d\n", List1Manager->NodeArray[7].next->position);
+	printf("Position 8 (prev) is %d\n", List1Manager->NodeArray[9].prev->position);
+	printf("Position 9 is %d\n", List1Manager->NodeArray[9].position);
+	printf("Position 9 (next) is %d\n", List1Manager->NodeArray[8].next->position);
+	printf("Position 9 (prev) is %d\n", List1Manager->NodeArray[10].prev->position);
+	printf("Position 10 is %d\n", List1Manager->NodeArray[10].position);
+	printf("Position 10 (next) is %d\n", List1Manager->NodeArray[9].next->position);
+	printf("Position 10 (prev) is %d\n", List1Manager->NodeArray[0].prev->position);
+	return 0;
+}
+
+*/
+
+
+/* Checks (build with -DLIBMDCL_TESTING to run them, e.g. cc -DLIBMDCL_TESTING LIBMDCLWithTesting.c && ./a.out) */
+
+#ifdef LIBMDCL_TESTING
+
+static int TestFailures = 0;
+
+static void Check(bool condition, const char* description)	// reports and counts a failed check
+{
+	if (!condition)
+	{
+		fprintf(stderr, "\nFAILED: %s\n", description);
+		TestFailures += 1;
+	}
+}
+
+
+static int EvictedCount = 0;
+static unsigned long long LastEvictedKey = 0;
+
+static void CountEviction(unsigned long long Key, void* data, void* context)	// eviction callback used by the LRU checks
+{
+	(void)data;
+	(void)context;
+	EvictedCount += 1;
+	LastEvictedKey = Key;
+}
+
+
+static void TestLRUCache(void)
+{
+	int values[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+	// recency order and eviction order
+	struct LRUCache* cache = CreateLRUCache(3, "LRU", CountEviction, NULL);
+	LRUPut(cache, 1, &values[1]);
+	LRUPut(cache, 2, &values[2]);
+	LRUPut(cache, 3, &values[3]);
+	Check(LRUGet(cache, 1) != NULL && LRUGet(cache, 1)->data == &values[1], "LRUGet finds a cached key");
+	LRUPut(cache, 4, &values[4]);
+	Check(EvictedCount == 1 && LastEvictedKey == 2, "LRUPut on a full cache evicts the least recently used key");
+	Check(LRUGet(cache, 2) == NULL, "an evicted key misses");
+	Check(cache->Manager->head->data == &values[4] && cache->Manager->tail->data == &values[3], "head is the most recent entry and tail the least recent");
+
+	// updating a key promotes it without evicting
+	LRUPut(cache, 3, &values[5]);
+	Check(EvictedCount == 1 && LRUGet(cache, 3)->data == &values[5] && cache->Count == 3, "LRUPut on an existing key updates it in place");
+
+	// explicit eviction drains in least recently used order
+	Check(LRUEvict(cache) && LastEvictedKey == 1, "LRUEvict removes the tail (1)");
+	Check(LRUEvict(cache) && LastEvictedKey == 4, "LRUEvict removes the tail (4)");
+	Check(LRUEvict(cache) && LastEvictedKey == 3, "LRUEvict removes the tail (3)");
+	Check(!LRUEvict(cache) && cache->Count == 0, "LRUEvict on an empty cache fails");
+	LRUPut(cache, 6, &values[6]);
+	Check(LRUGet(cache, 6) != NULL && cache->Count == 1, "an emptied cache can be filled again");
+	DeleteLRUCache(cache);
+
+	// a single entry cache
+	EvictedCount = 0;
+	cache = CreateLRUCache(1, "LRU1", CountEviction, NULL);
+	LRUPut(cache, 10, &values[0]);
+	LRUPut(cache, 11, &values[1]);
+	Check(EvictedCount == 1 && LastEvictedKey == 10 && LRUGet(cache, 11) != NULL && LRUGet(cache, 10) == NULL, "a capacity 1 cache keeps only the newest key");
+	DeleteLRUCache(cache);
+
+	// keys with long probe runs, evicting from the middle of a run has to keep later keys reachable
+	cache = CreateLRUCache(64, "LRUProbe", NULL, NULL);
+	for (unsigned long long Key = 0; Key < 1000; Key++)
+	{
+		LRUPut(cache, Key * 128, NULL);
+	}
+	bool found = true;
+	for (unsigned long long Key = 0; Key < 1000; Key++)
+	{
+		if ((LRUGet(cache, Key * 128) != NULL) != (Key >= 936))
+		{
+			found = false;
+		}
+	}
+	Check(found && cache->Count == 64, "only the last 64 of 1000 keys are cached");
+	DeleteLRUCache(cache);
+
+	// random operations against a simple array model, most recent key first
+	srand(26);
+	for (int Capacity = 1; Capacity <= 8; Capacity++)
+	{
+		unsigned long long model[8];
+		int ModelCount = 0;
+		bool matches = true;
+		EvictedCount = 0;
+		cache = CreateLRUCache(Capacity, "LRURandom", CountEviction, NULL);
+
+		for (int i = 0; i < 20000 && matches; i++)
+		{
+			unsigned long long Key = rand() % 16;
+			int index = -1;
+			for (int j = 0; j < ModelCount; j++)
+			{
+				if (model[j] == Key)
+				{
+					index = j;
+				}
+			}
+
+			int operation = rand() % 5;
+			if (operation < 2)
+			{
+				matches = (LRUGet(cache, Key) != NULL) == (index >= 0);
+			}
+			else if (operation < 4)
+			{
+				int evictions = EvictedCount;
+				LRUPut(cache, Key, NULL);
+				if (index < 0 && ModelCount == Capacity)
+				{
+					matches = EvictedCount == evictions + 1 && LastEvictedKey == model[ModelCount - 1];
+					index = ModelCount - 1;
+				}
+				else if (index < 0)
+				{
+					index = ModelCount;
+					ModelCount += 1;
+				}
+			}
+			else
+			{
+				// evicting from an empty cache is checked above
+				if (ModelCount > 0)
+				{
+					matches = LRUEvict(cache) && LastEvictedKey == model[ModelCount - 1];
+					ModelCount -= 1;
+				}
+				continue;
+			}
+
+			// moving the touched key to the front of the model, dropping whatever sat at index
+			if (index >= 0)
+			{
+				memmove(&model[1], &model[0], index * sizeof(unsigned long long));
+				model[0] = Key;
+			}
+			matches = matches && cache->Count == ModelCount;
+		}
+
+		// walking head to tail has to give the model order
+		struct Node* Node = cache->Manager->head;
+		for (int j = 0; j < ModelCount && matches; j++)
+		{
+			matches = cache->Keys[Node->position] == model[j] && Node->next->prev == Node;
+			Node = Node->next;
+		}
+		Check(matches, "random LRU operations match the model");
+		DeleteLRUCache(cache);
+	}
+}
+
+
+static struct NodeManager* CreateTestList(int NodeCount, int* values)	// creates a list whose node i holds &values[i]
+{
+	struct NodeManager* NodeManager = CreateList(NodeCount, "Test");
+	for (int i = 0; i < NodeCount; i++)
+	{
+		NodeManager->NodeArray[i].data = &values[i];
+	}
+
+	return NodeManager;
+}
+
+
+static bool ListMatches(struct NodeManager* NodeManager, void** expected, int count)	// walks the list from head checking data in order, links both ways and that it closes back on head
+{
+	struct Node* Node = NodeManager->head;
+	for (int i = 0; i < count; i++)
+	{
+		if (Node->data != expected[i] || Node->next->prev != Node)
+		{
+			return false;
+		}
+		Node = Node->next;
+	}
+
+	return Node == NodeManager->head && NodeManager->tail->next == NodeManager->head && NodeManager->NodeCount - NodeManager->TombstoneCount == count;
+}
+
+
+static void TestListBatch(void)
+{
+	int values[5] = { 0, 1, 2, 3, 4 };
+	int inserted[4] = { 10, 11, 12, 13 };
+
+	// mixed operations in pre-batch positions
+	struct NodeManager* list = CreateTestList(5, values);
+	struct ListBatch* batch = BeginListBatch(list);
+	BatchInsertNode(batch, 2, &inserted[1]);
+	BatchDeleteNode(batch, 4);
+	BatchInsertNode(batch, 0, &inserted[0]);
+	BatchDeleteNode(batch, 1);
+	BatchInsertNode(batch, 2, &inserted[2]);
+	BatchInsertNode(batch, 5, &inserted[3]);
+	Check(CommitListBatch(batch), "CommitListBatch applies a valid batch");
+	void* expected[] = { &inserted[0], &values[0], &inserted[1], &inserted[2], &values[2], &values[3], &inserted[3] };
+	Check(ListMatches(list, expected, 7), "inserts go in front of their pre-batch node in queue order and deletes remove pre-batch nodes");
+	bool positions = true;
+	for (int i = 0; i < list->NodeCount; i++)
+	{
+		positions = positions && list->NodeArray[i].position == i;
+	}
+	Check(positions && list->head == &list->NodeArray[0] && list->tail == &list->NodeArray[6], "positions, head and tail are renumbered");
+	DeleteList(list);
+
+	// failed commits leave the list untouched
+	void* original[] = { &values[0], &values[1], &values[2], &values[3], &values[4] };
+	list = CreateTestList(5, values);
+	batch = BeginListBatch(list);
+	BatchDeleteNode(batch, 1);
+	BatchDeleteNode(batch, 1);
+	Check(!CommitListBatch(batch) && ListMatches(list, original, 5), "deleting a node twice fails");
+
+	batch = BeginListBatch(list);
+	for (int i = 0; i < 5; i++)
+	{
+		BatchDeleteNode(batch, i);
+	}
+	Check(!CommitListBatch(batch) && ListMatches(list, original, 5), "emptying the list fails");
+
+	batch = BeginListBatch(list);
+	BatchInsertNode(batch, 0, &inserted[0]);
+	Check(CancelListBatch(batch) && ListMatches(list, original, 5), "CancelListBatch applies nothing");
+
+	// a same size change between begin and commit still makes the batch stale
+	batch = BeginListBatch(list);
+	BatchDeleteNode(batch, 0);
+	InsertNodeAtBeginning(list)->data = &inserted[0];
+	DeleteNodeAtEnd(list);
+	void* changed[] = { &inserted[0], &values[0], &values[1], &values[2], &values[3] };
+	Check(!CommitListBatch(batch) && ListMatches(list, changed, 5), "a batch fails once the list changed since BeginListBatch");
+	DeleteList(list);
+
+	// random batches against an array model
+	srand(27);
+	bool matches = true;
+	for (int round = 0; round < 500 && matches; round++)
+	{
+		int NodeCount = 2 + rand() % 20;
+		int data[64];
+		void* model[64];
+		void* InsertsAt[23][4];
+		int InsertCount[23] = { 0 };
+		bool deleted[22] = { false };
+
+		list = CreateTestList(NodeCount, data);
+		batch = BeginListBatch(list);
+		for (int i = rand() % 12; i > 0; i--)
+		{
+			int position = rand() % (NodeCount + 1);
+			if (rand() % 2 && InsertCount[position] < 4)
+			{
+				InsertsAt[position][InsertCount[position]++] = &data[32 + i];
+				BatchInsertNode(batch, position, &data[32 + i]);
+			}
+			else if (position < NodeCount && !deleted[position])
+			{
+				deleted[position] = true;
+				BatchDeleteNode(batch, position);
+			}
+		}
+
+		int ModelCount = 0;
+		for (int position = 0; position <= NodeCount; position++)
+		{
+			for (int i = 0; i < InsertCount[position]; i++)
+			{
+				model[ModelCount++] = InsertsAt[position][i];
+			}
+			if (position < NodeCount && !deleted[position])
+			{
+				model[ModelCount++] = &data[position];
+			}
+		}
+
+		matches = ModelCount == 0 ? !CommitListBatch(batch) : CommitListBatch(batch) && ListMatches(list, model, ModelCount);
+		DeleteList(list);
+	}
+	Check(matches, "random batches match the model");
+}
+
+
+static void TestLazyDelete(void)
+{
+	int values[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	int inserted[4] = { 10, 11, 12, 13 };
+
+	// deletes only unlink, positions stay NodeArray indexes
+	struct NodeManager* list = CreateTestList(10, values);
+	EnableLazyDelete(list, 0.5);
+	struct NodeHandle handles[10];
+	for (int i = 0; i < 10; i++)
+	{
+		handles[i] = GetNodeHandle(list, i);
+	}
+	Check(DeleteNodeAtPosition(list, 2) && DeleteNodeAtPosition(list, 3), "lazy deletes succeed");
+	void* AfterDeletes[] = { &values[0], &values[1], &values[4], &values[5], &values[6], &values[7], &values[8], &values[9] };
+	Check(ListMatches(list, AfterDeletes, 8) && list->NodeCount == 10 && list->TombstoneCount == 2, "tombstones are skipped by traversal and stay in NodeArray");
+	Check(list->NodeArray[4].data == &values[4] && list->NodeArray[4].position == 4, "later nodes are not renumbered");
+	Check(ResolveNodeHandle(list, handles[2]) == NULL && ResolveNodeHandle(list, handles[4]) == &list->NodeArray[4], "handles to deleted nodes are stale and others still resolve");
+	Check(!DeleteNodeAtPosition(list, 2) && !SetNodeData(list, 3, &values[3]), "a tombstone cannot be deleted again or written");
+	Check(GetNodeData(list, 2) == NULL && GetNodeView(list, 2) == NULL && GetNextPosition(list, 2) == -1 && GetPrevPosition(list, 3) == -1, "a tombstone cannot be read or followed");
+	Check(list->NodeArray[2].next == NULL && list->NodeArray[3].prev == NULL, "tombstones keep no links");
+
+	// inserting at the end neither compacts nor moves anything
+	InsertNodeAtEnd(list)->data = &inserted[0];
+	Check(list->TombstoneCount == 2 && ResolveNodeHandle(list, handles[5]) != NULL && ResolveNodeHandle(list, handles[9]) != NULL, "InsertNodeAtEnd keeps tombstones and handles");
+
+	// inserting at a NodeArray index shifts live nodes and tombstones together
+	InsertNodeAtPosition(list, 4)->data = &inserted[1];
+	void* AfterInsert[] = { &values[0], &values[1], &inserted[1], &values[4], &values[5], &values[6], &values[7], &values[8], &values[9], &inserted[0] };
+	Check(ListMatches(list, AfterInsert, 10) && list->NodeArray[4].data == &inserted[1] && list->TombstoneCount == 2, "InsertNodeAtPosition uses the NodeArray index");
+	Check(list->Generations[2] == 0 && list->Generations[3] == 0 && list->NodeArray[5].data == &values[4], "tombstones before the insert stay put and later nodes shift up");
+	Check(ResolveNodeHandle(list, handles[1]) != NULL && ResolveNodeHandle(list, handles[4]) == NULL && ResolveNodeHandle(list, handles[5]) == NULL, "handles before the insert resolve and handles to shifted nodes are stale");
+
+	// batches use NodeArray indexes too and carry tombstones along
+	struct ListBatch* batch = BeginListBatch(list);
+	BatchDeleteNode(batch, 3);
+	Check(!CommitListBatch(batch), "a batch cannot delete a tombstone");
+	batch = BeginListBatch(list);
+	BatchInsertNode(batch, 1, &inserted[2]);
+	BatchDeleteNode(batch, 6);
+	Check(CommitListBatch(batch), "a batch commits on a lazy delete list");
+	void* AfterBatch[] = { &values[0], &inserted[2], &values[1], &inserted[1], &values[4], &values[6], &values[7], &values[8], &values[9], &inserted[0] };
+	Check(ListMatches(list, AfterBatch, 10) && list->TombstoneCount == 2 && list->Generations[3] == 0 && list->Generations[4] == 0, "batch positions are NodeArray indexes and tombstones are kept");
+	Check(ResolveNodeHandle(list, handles[0]) != NULL && ResolveNodeHandle(list, handles[1]) == NULL, "a batch only invalidates handles of nodes it moved");
+
+	// CompactList renumbers, only nodes that moved lose their handles
+	struct NodeHandle first = GetNodeHandle(list, 0);
+	struct NodeHandle last = GetNodeHandle(list, 11);
+	Check(CompactList(list) && ListMatches(list, AfterBatch, 10) && list->NodeCount == 10 && list->TombstoneCount == 0, "CompactList removes tombstones");
+	Check(ResolveNodeHandle(list, first) != NULL && ResolveNodeHandle(list, last) == NULL, "CompactList keeps handles of unmoved nodes");
+	DeleteList(list);
+
+	// the ratio triggers compaction on its own
+	list = CreateTestList(8, values);
+	EnableLazyDelete(list, 0.25);
+	DeleteNodeAtBeginning(list);
+	DeleteNodeAtEnd(list);
+	Check(list->TombstoneCount == 2 && list->NodeCount == 8, "compaction waits for the ratio");
+	DeleteNodeAtPosition(list, 3);
+	void* compacted[] = { &values[1], &values[2], &values[4], &values[5], &values[6] };
+	Check(list->TombstoneCount == 0 && list->NodeCount == 5 && ListMatches(list, compacted, 5) && list->NodeArray[4].position == 4, "exceeding the ratio compacts and renumbers");
+	Check(DisableLazyDelete(list) && list->Generations == NULL && ResolveNodeHandle(list, GetNodeHandle(list, 0)) == NULL, "DisableLazyDelete drops generations");
+	DeleteList(list);
+
+	// tombstone links do not survive the NodeArray moving on later inserts
+	list = CreateTestList(4, values);
+	EnableLazyDelete(list, 1.0);
+	DeleteNodeAtPosition(list, 1);
+	for (int i = 0; i < 200; i++)
+	{
+		InsertNodeAtEnd(list);
+	}
+	Check(GetNextPosition(list, 1) == -1 && list->NodeArray[1].next == NULL && GetNextPosition(list, 0) == 2, "a tombstone stays unreachable after NodeArray grows");
+	DeleteList(list);
+
+	// a batch that shrinks the list applies the ratio as well
+	list = CreateTestList(10, values);
+	EnableLazyDelete(list, 0.5);
+	DeleteNodeAtPosition(list, 0);
+	DeleteNodeAtPosition(list, 1);
+	batch = BeginListBatch(list);
+	for (int i = 2; i < 9; i++)
+	{
+		BatchDeleteNode(batch, i);
+	}
+	void* AfterShrink[] = { &values[9] };
+	Check(CommitListBatch(batch) && list->TombstoneCount == 0 && list->NodeCount == 1 && ListMatches(list, AfterShrink, 1), "a batch leaving too many tombstones compacts the list");
+	DeleteList(list);
+
+	// random operations against an array model of the live nodes
+	srand(28);
+	bool matches = true;
+	for (int round = 0; round < 100 && matches; round++)
+	{
+		int data[512];
+		void* model[512];
+		int ModelCount = 8;
+		int next = 8;
+		struct NodeHandle RandomHandles[16];
+		void* HandleData[16];
+		int HandleCount = 0;
+
+		list = CreateTestList(8, data);
+		for (int i = 0; i < 8; i++)
+		{
+			model[i] = &data[i];
+		}
+		EnableLazyDelete(list, 0.1 + (rand() % 9) / 10.0);
+
+		for (int step = 0; step < 300 && matches; step++)
+		{
+			int operation = rand() % 4;
+			int position = rand() % list->NodeCount;
+			int LiveBefore = 0;
+			for (int i = 0; i < position; i++)
+			{
+				LiveBefore += list->Generations[i] != 0;
+			}
+
+			if (operation == 0 && ModelCount > 1 && list->Generations[position] != 0)
+			{
+				DeleteNodeAtPosition(list, position);
+				for (int i = 0; i < HandleCount; i++)
+				{
+					HandleData[i] = HandleData[i] == model[LiveBefore] ? NULL : HandleData[i];
+				}
+				memmove(&model[LiveBefore], &model[LiveBefore + 1], (ModelCount - LiveBefore - 1) * sizeof(void*));
+				ModelCount -= 1;
+			}
+			else if (operation == 1 && next < 500)
+			{
+				InsertNodeAtPosition(list, position)->data = &data[next];
+				memmove(&model[LiveBefore + 1], &model[LiveBefore], (ModelCount - LiveBefore) * sizeof(void*));
+				model[LiveBefore] = &data[next++];
+				ModelCount += 1;
+			}
+			else if (operation == 2 && HandleCount < 16 && list->Generations[position] != 0)
+			{
+				RandomHandles[HandleCount] = GetNodeHandle(list, position);
+				HandleData[HandleCount++] = list->NodeArray[position].data;
+			}
+
+			matches = ListMatches(list, model, ModelCount);
+			for (int i = 0; i < HandleCount && matches; i++)
+			{
+				struct Node* Node = ResolveNodeHandle(list, RandomHandles[i]);
+				matches = Node == NULL || (HandleData[i] != NULL && Node->data == HandleData[i]);
+			}
+		}
+		DeleteList(list);
+	}
+	Check(matches, "random lazy delete operations match the model");
+}
+
+
+static bool SplitListMatches(struct NodeManager* NodeManager, void** expected, int count)	// walks a split list through the accessors checking data in order and links both ways
+{
+	int position = 0;
+	for (int i = 0; i < count; i++)
+	{
+		if (GetNodeData(NodeManager, position) != expected[i] || GetPrevPosition(NodeManager, GetNextPosition(NodeManager, position)) != position)
+		{
+			return false;
+		}
+		position = GetNextPosition(NodeManager, position);
+	}
+
+	return position == 0 && NodeManager->NodeCount == count;
+}
+
+
+static void TestSplitLayout(void)
+{
+	int values[5] = { 0, 1, 2, 3, 4 };
+	int inserted[4] = { 10, 11, 12, 13 };
+
+	// a new split list has no struct Node view
+	struct NodeManager* list = CreateSplitList(5, "Split");
+	Check(list->NodeArray == NULL && list->head == NULL && list->tail == NULL && GetNodeData(list, 4) == NULL, "CreateSplitList allocates only payloads");
+	for (int i = 0; i < 5; i++)
+	{
+		SetNodeData(list, i, &values[i]);
+	}
+	void* original[] = { &values[0], &values[1], &values[2], &values[3], &values[4] };
+	Check(SplitListMatches(list, original, 5), "SetNodeData and GetNodeData use the payload array");
+	Check(GetNextPosition(list, 4) == 0 && GetPrevPosition(list, 0) == 4, "links wrap around");
+
+	// inserts and deletes through the split functions
+	Check(InsertSplitNode(list, 0, &inserted[0]) == 0 && InsertSplitNode(list, 3, &inserted[1]) == 3 && InsertSplitNode(list, 7, &inserted[2]) == 7, "InsertSplitNode returns the new position");
+	void* AfterInserts[] = { &inserted[0], &values[0], &values[1], &inserted[1], &values[2], &values[3], &values[4], &inserted[2] };
+	Check(SplitListMatches(list, AfterInserts, 8), "InsertSplitNode shifts later payloads");
+	Check(InsertSplitNode(list, 9, NULL) == -1 && InsertNodeAtEnd(list) == NULL && list->NodeCount == 8, "out of bounds and struct Node inserts fail on a split list");
+	Check(DeleteSplitNode(list, 3) && DeleteNodeAtBeginning(list) && DeleteNodeAtEnd(list) && SplitListMatches(list, original, 5), "deletes shift payloads back");
+
+	// the view is a read only copy that data writes keep in step
+	const struct Node* view = GetNodeView(list, 2);
+	Check(view != NULL && view->data == &values[2] && view->position == 2 && list->head == &list->NodeArray[0] && list->tail->next == list->head, "GetNodeView builds the view");
+	SetNodeData(list, 2, &inserted[3]);
+	EmptyNodeData(list, 3);
+	Check(GetNodeView(list, 2) == view && view->data == &inserted[3] && list->NodeArray[3].data == NULL, "data writes update the existing view in place");
+	InsertSplitNode(list, 0, &inserted[0]);
+	Check(list->NodeArray == NULL && list->head == NULL, "an insert frees the view");
+	GetNodeView(list, 0);
+	Check(ReleaseNodeView(list) && list->NodeArray == NULL, "ReleaseNodeView frees the view");
+
+	// batches and lazy deletes
+	struct ListBatch* batch = BeginListBatch(list);
+	BatchDeleteNode(batch, 0);
+	BatchInsertNode(batch, 6, &inserted[2]);
+	BatchInsertNode(batch, 3, &inserted[1]);
+	Check(CommitListBatch(batch), "a batch commits on a split list");
+	void* AfterBatch[] = { &values[0], &values[1], &inserted[1], &inserted[3], NULL, &values[4], &inserted[2] };
+	Check(SplitListMatches(list, AfterBatch, 7), "batch positions work the same on a split list");
+	Check(!EnableLazyDelete(list, 0.5), "lazy deletes are rejected on a split list");
+	while (list->NodeCount > 1)
+	{
+		DeleteSplitNode(list, 0);
+	}
+	Check(!DeleteSplitNode(list, 0) && list->NodeCount == 1, "the last node cannot be deleted");
+	DeleteList(list);
+
+	// random operations against an array model
+	srand(29);
+	bool matches = true;
+	for (int round = 0; round < 100 && matches; round++)
+	{
+		int data[512];
+		void* model[512];
+		int ModelCount = 1 + rand() % 10;
+		int next = ModelCount;
+
+		list = CreateSplitList(ModelCount, "SplitRandom");
+		for (int i = 0; i < ModelCount; i++)
+		{
+			SetNodeData(list, i, &data[i]);
+			model[i] = &data[i];
+		}
+
+		for (int step = 0; step < 200 && matches; step++)
+		{
+			int operation = rand() % 3;
+			if (operation == 0 && next < 500)
+			{
+				int position = rand() % (ModelCount + 1);
+				matches = InsertSplitNode(list, position, &data[next]) == position;
+				memmove(&model[position + 1], &model[position], (ModelCount - position) * sizeof(void*));
+				model[position] = &data[next++];
+				ModelCount += 1;
+			}
+			else if (operation == 1 && ModelCount > 1)
+			{
+				int position = rand() % ModelCount;
+				matches = DeleteNodeAtPosition(list, position);
+				memmove(&model[position], &model[position + 1], (ModelCount - position - 1) * sizeof(void*));
+				ModelCount -= 1;
+			}
+			else if (operation == 2)
+			{
+				int position = rand() % ModelCount;
+				const struct Node* Node = GetNodeView(list, position);
+				matches = Node->data == model[position] && Node->next == &list->NodeArray[(position + 1) % ModelCount];
+			}
+
+			matches = matches && SplitListMatches(list, model, ModelCount);
+		}
+		DeleteList(list);
+	}
+	Check(matches, "random split list operations match the model");
+}
+
+
+int main()
+{
+	TestLRUCache();
+	TestListBatch();
+	TestLazyDelete();
+	TestSplitLayout();
+
+	printf("%s\n", TestFailures == 0 ? "All checks passed" : "Some checks failed");
+	return TestFailures == 0 ? 0 : 1;
+}
+
+#endif